@@ -1946,7 +1946,8 @@ vastReleaseBufferHandle(VASTDisplay dpy, VASTBufferID buf_id);
  *   (VA_EXPORT_SURFACE_*).
  * @param[out] descriptor  Pointer to the descriptor structure to fill
  *   with the handle details.  The type of this structure depends on
- *   the value of mem_type.
+ *   the value of mem_type: #VASTDRMPRIMESurfaceDescriptor for
+ *   VAST_SURFACE_ATTRIB_MEM_TYPE_DRM_PRIME_2 (see va_drmcommon.h).
  *
  * @return Status code:
  * - VAST_STATUS_SUCCESS:    Success.
@@ -1963,6 +1964,38 @@ VASTStatus vastExportSurfaceHandle(VASTDisplay dpy,
                                uint32_t mem_type, uint32_t flags,
                                void *descriptor);
 
+/**
+ * \brief Exports a fence for the pending operations on a surface
+ *
+ * Returns a sync_file descriptor that signals once all operations
+ * queued on the surface so far have completed. An external consumer of
+ * an exported surface waits on it instead of the producer calling
+ * vastSyncSurface(). The descriptor is owned by the caller.
+ *
+ * @param[in] dpy          VA display.
+ * @param[in] surface_id   Surface the fence is taken on.
+ * @param[out] sync_fd     The sync_file descriptor.
+ */
+VASTStatus vastExportSurfaceFence(VASTDisplay dpy,
+                                  VASTSurfaceID surface_id,
+                                  int *sync_fd);
+
+/**
+ * \brief Imports a fence guarding the external use of a surface
+ *
+ * Operations queued on the surface after this call wait on the device
+ * until \c sync_fd signals, e.g. until an external consumer has
+ * finished reading an exported surface. Ownership of \c sync_fd is
+ * transferred to the driver.
+ *
+ * @param[in] dpy          VA display.
+ * @param[in] surface_id   Surface the fence applies to.
+ * @param[in] sync_fd      The sync_file descriptor, or -1 for none.
+ */
+VASTStatus vastImportSurfaceFence(VASTDisplay dpy,
+                                  VASTSurfaceID surface_id,
+                                  int sync_fd);
+
 typedef enum
 {
     VASTSurfaceRendering	= 1, /* Rendering in progress */ 
@@ -2386,6 +2419,137 @@ VASTStatus vastCreateDmaHandle(
     void *dma_handle
 );
 
+/** @name Host staging memory flags */
+/**@{*/
+/** \brief Back the allocation with 2 MB hugepages. */
+#define VAST_HOST_MEMORY_HUGEPAGE         0x00000001
+/** \brief Pin the allocation and register it for DMA once, at allocation time. */
+#define VAST_HOST_MEMORY_DMA_REGISTER     0x00000002
+/**@}*/
+
+/** \brief Allocate on any NUMA node. */
+#define VAST_HOST_MEMORY_NUMA_ANY         (-1)
+
+/** \brief Host staging memory attributes. */
+typedef struct _VASTHostMemoryAttrib {
+    /** \brief Combination of "Host staging memory flags". */
+    uint32_t        flags;
+    /** \brief NUMA node to allocate on, or #VAST_HOST_MEMORY_NUMA_ANY. */
+    int32_t         numa_node;
+    /** \brief Alignment in bytes, zero for the page size in use. */
+    uint32_t        alignment;
+
+    /** \brief Reserved bytes for future use, must be zero */
+    uint32_t                va_reserved[VAST_PADDING_LOW];
+} VASTHostMemoryAttrib;
+
+/**
+ * Allocates host staging memory for uploads and readbacks.
+ * With VAST_HOST_MEMORY_DMA_REGISTER the memory is pinned once, so DMA
+ * from it never faults or re-pins. If no hugepage is free, the
+ * allocation falls back to regular pages, see vastQueryHostMemory().
+ */
+VASTStatus vastAllocHostMemory (
+    size_t size,
+    const VASTHostMemoryAttrib *attrib,	/* in, NULL for defaults */
+    void **ptr	/* out */
+);
+
+VASTStatus vastFreeHostMemory (
+    void *ptr
+);
+
+/**
+ * Returns the attributes actually obtained for an allocation made by
+ * vastAllocHostMemory(), e.g. whether it is hugepage-backed.
+ */
+VASTStatus vastQueryHostMemory (
+    const void *ptr,
+    VASTHostMemoryAttrib *attrib,	/* out */
+    size_t *size	/* out */
+);
+
+/** \brief PCIe and NUMA placement of a die. */
+typedef struct _VASTDieTopology {
+    /** \brief Die index. */
+    int32_t         die_id;
+    /** \brief PCI address of the card the die sits on. */
+    uint32_t        pci_domain;
+    uint32_t        pci_bus;
+    uint32_t        pci_device;
+    uint32_t        pci_function;
+    /** \brief NUMA node of the PCIe root port, -1 if unknown. */
+    int32_t         numa_node;
+    /** \brief Number of CPUs local to \ref numa_node. */
+    uint32_t        num_cpus;
+    /** \brief CPUs local to \ref numa_node, bit n % 64 of word n / 64 is CPU n. */
+    uint64_t        cpu_mask[16];
+
+    /** \brief Reserved bytes for future use, must be zero */
+    uint32_t                va_reserved[VAST_PADDING_LOW];
+} VASTDieTopology;
+
+/**
+ * Returns the PCIe and NUMA placement of a die, and the CPUs local to
+ * it. Threads submitting work to the die should be pinned to those
+ * CPUs, and staging memory allocated with vastAllocHostMemory() on
+ * numa_node.
+ * die_id -1 selects the die the display is bound to.
+ */
+VASTStatus vastQueryDieTopology (
+    VASTDisplay dpy,
+    int die_id,
+    VASTDieTopology *topology	/* out */
+);
+
+/** \brief Device memory held, in bytes, broken down by what holds it. */
+typedef struct _VASTMemoryUsage {
+    /** \brief Surfaces created with vastCreateSurfaces(). */
+    uint64_t        surfaces;
+    /** \brief Buffers of type #VASTEncCodedBufferType. */
+    uint64_t        coded_buffers;
+    /** \brief Encoder reconstructed and reference frames. */
+    uint64_t        recon;
+    /** \brief Encoder lookahead and cutree buffers. */
+    uint64_t        lookahead;
+    /** \brief Other buffers created with vastCreateBuffer(). */
+    uint64_t        buffers;
+    /** \brief Memory behind DMA handles. */
+    uint64_t        dma;
+    /** \brief Device memory of the die, zero for per-context queries. */
+    uint64_t        total;
+    /** \brief Device memory still free on the die, zero for per-context queries. */
+    uint64_t        available;
+
+    /** \brief Reserved bytes for future use, must be zero */
+    uint32_t                va_reserved[VAST_PADDING_LOW];
+} VASTMemoryUsage;
+
+/**
+ * Returns the device memory held by a context, or by the whole die the
+ * display is bound to when context is VAST_INVALID_ID.
+ * Can be called at any time; the figures are a snapshot.
+ */
+VASTStatus vastQueryMemoryUsage (
+    VASTDisplay dpy,
+    VASTContextID context,
+    VASTMemoryUsage *usage	/* out */
+);
+
+/**
+ * Predicts the device memory an encode session will need, from the
+ * same parameters that will be passed at config and context creation.
+ * Needs no device, so admission control can refuse a session against
+ * vastQueryMemoryUsage() before creating it instead of failing with
+ * VAST_STATUS_ERROR_ALLOCATION_FAILED mid-stream.
+ * The total and available fields of usage are left zero.
+ */
+VASTStatus vastEstimateEncodeMemory (
+    VASTProfile profile,
+    const VAEncMiscParameter *param,
+    VASTMemoryUsage *usage	/* out */
+);
+
 VASTStatus vastGetDieinfo (
     VASTDisplay dpy,
     int* die_id	/* out */
@@ -2853,6 +3017,43 @@ VASTStatus vastDeviceMemcpy(VASTDisplay dpy,
                             void *dma_handle
 );
 
+/** @name vastCopySurfacePeer() flags */
+/**@{*/
+/** \brief Fail with VAST_STATUS_ERROR_FLAG_NOT_SUPPORTED instead of
+ *  falling back to host staging when peer DMA is not possible. */
+#define VAST_PEER_COPY_P2P_ONLY           0x00000001
+/** \brief Always go through pipelined host staging. */
+#define VAST_PEER_COPY_STAGED             0x00000002
+/**@}*/
+
+/**
+ * Reports whether peer-to-peer DMA is possible between the dies of two
+ * displays, i.e. both cards sit below a PCIe switch or root complex
+ * that forwards peer traffic.
+ */
+VASTStatus vastQueryPeerAccess(
+    VASTDisplay src_dpy,
+    VASTDisplay dst_dpy,
+    int *p2p_supported	/* out */
+);
+
+/**
+ * Copies a surface to a surface on another die without a host bounce.
+ * Uses peer DMA when vastQueryPeerAccess() allows it. Otherwise the
+ * copy goes through a small host staging ring, with the read from the
+ * source die pipelined against the write to the destination die.
+ * Both surfaces must have the same format and size. The call returns
+ * once the copy is queued; vastSyncSurface() on dst_surface waits for
+ * it.
+ */
+VASTStatus vastCopySurfacePeer(
+    VASTDisplay src_dpy,
+    VASTSurfaceID src_surface,
+    VASTDisplay dst_dpy,
+    VASTSurfaceID dst_surface,
+    uint32_t flags
+);
+
 
 VASTStatus vastQueWriteDmaBufSg(
     VASTDisplay dpy,
@@ -0,0 +1,255 @@
+/**
+ * \file va_dec_host.h
+ * \brief Host helpers for the decode front end
+ *
+ * This file contains the \ref api_dec_host "host decode helpers".
+ * They run on the CPU, need no device, and are exported by the driver
+ * next to the host filters of va_vpp.h. va.h and va_vpp.h, which
+ * defines the VAST_PROC_HOST_ISA_* values taken by the \c isa
+ * arguments, shall be included first.
+ */
+
+#ifndef VAST_DEC_HOSTAI_H
+#define VAST_DEC_HOSTAI_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \defgroup api_dec_host Host decode helpers
+ *
+ * @{
+ *
+ * The \c isa argument of the functions below takes one of the "Host
+ * filter instruction sets" of va_vpp.h. All paths give the same
+ * results.
+ */
+
+/** \brief NAL unit located by vastHostSplitNalUnits(). */
+typedef struct _VASTHostNalUnit {
+    /** \brief Offset in the buffer of the first byte after the start code. */
+    uint32_t        offset;
+    /** \brief Size in bytes, up to the next start code, trailing zero bytes excluded. */
+    uint32_t        size;
+    /** \brief nal_unit_type read from the NAL unit header. */
+    uint8_t         type;
+    /** \brief Length of the start code preceding the unit, 3 or 4. */
+    uint8_t         start_code_size;
+    /** \brief Reserved for alignment, must be zero. */
+    uint8_t         reserved[2];
+} VASTHostNalUnit;
+
+/**
+ * \brief Finds the next Annex-B start code.
+ *
+ * @param[in] buf               the bitstream
+ * @param[in] size              the number of bytes in \c buf
+ * @param[in] isa               one of the "Host filter instruction sets"
+ * @param[out] offset           the offset of the first byte of the next
+ *      00 00 01 sequence, or \c size if there is none
+ */
+VASTStatus
+vastHostFindStartCode(
+    const uint8_t  *buf,
+    size_t          size,
+    uint32_t        isa,
+    size_t         *offset
+);
+
+/**
+ * \brief Splits an Annex-B bitstream into NAL units.
+ *
+ * The units are returned in bitstream order. Their \c offset and
+ * \c size can be passed as is to vastapi_decode_make_slice_buffer(), so
+ * slice data goes from the input buffer to the slice buffer in a single
+ * copy. A unit still open at the end of \c buf is returned as well; the
+ * caller decides whether more data will follow.
+ *
+ * Possible errors:
+ * - \ref VAST_STATUS_ERROR_UNSUPPORTED_PROFILE: \c profile is not an
+ *   H.264 or HEVC profile
+ * - \ref VAST_STATUS_ERROR_MAX_NUM_EXCEEDED: \c units is too small, the
+ *   required number of elements is returned in \c num_units
+ *
+ * @param[in] profile           selects the H.264 or HEVC NAL unit header
+ * @param[in] buf               the bitstream
+ * @param[in] size              the number of bytes in \c buf
+ * @param[out] units            the output array of #VASTHostNalUnit elements
+ * @param[in,out] num_units     the number of elements allocated on input,
+ *      the number of elements actually filled in on output
+ * @param[in] isa               one of the "Host filter instruction sets"
+ */
+VASTStatus
+vastHostSplitNalUnits(
+    VASTProfile         profile,
+    const uint8_t      *buf,
+    size_t              size,
+    VASTHostNalUnit    *units,
+    unsigned int       *num_units,
+    uint32_t            isa
+);
+
+/**
+ * \brief Removes emulation prevention bytes from a NAL unit.
+ *
+ * Every 03 following 00 00 is dropped, which gives the RBSP that header
+ * parsers read. \c dst may be equal to \c src for an in-place removal,
+ * or point into a buffer mapped with vastMapBuffer().
+ *
+ * @param[in] src               the NAL unit, start code excluded
+ * @param[in] src_size          the number of bytes in \c src
+ * @param[out] dst              the output, at least \c src_size bytes
+ * @param[out] dst_size         the number of bytes written to \c dst
+ * @param[in] isa               one of the "Host filter instruction sets"
+ */
+VASTStatus
+vastHostRemoveEmulationPrevention(
+    const uint8_t  *src,
+    size_t          src_size,
+    uint8_t        *dst,
+    size_t         *dst_size,
+    uint32_t        isa
+);
+
+/** \brief Maximum number of surfaces released by one vastHostParsePicture() call. */
+#define VAST_HOST_PARSER_MAX_RELEASED     16
+
+/** \brief Picture parsed by vastHostParsePicture(). */
+typedef struct _VASTHostParsedPicture {
+    /** \brief Picture parameters, the member matching the parser profile is filled. */
+    union {
+        VASTPictureParameterBufferH264      h264;
+        VASTPictureParameterBufferHEVC      hevc;
+        VASTDecPictureParameterBufferAV1    av1;
+    } pic_param;
+    /** \brief Scaling lists, valid when \ref has_iq_matrix is set. */
+    union {
+        VASTIQMatrixBufferH264              h264;
+        VASTIQMatrixBufferHEVC              hevc;
+    } iq_matrix;
+    uint32_t        has_iq_matrix;
+    /**
+     * \brief Slice parameters, allocated by the caller.
+     *
+     * Array of #VASTSliceParameterBufferH264, #VASTSliceParameterBufferHEVC
+     * or #VASTSliceParameterBufferAV1 elements, one per slice or tile. The
+     * slice data offsets are relative to the buffer given to
+     * vastHostParsePicture().
+     */
+    void           *slice_params;
+    /** \brief Number of elements allocated in \ref slice_params on input,
+     *  number of elements filled in on output. */
+    uint32_t        num_slices;
+    /** \brief Set when the picture is used for reference. */
+    uint32_t        is_reference;
+    /** \brief Set for IDR, IRAP and AV1 key frames. */
+    uint32_t        is_keyframe;
+    /**
+     * \brief Set when the picture is output once decoded.
+     *
+     * Cleared for AV1 frames with \c show_frame equal to 0, which are only
+     * shown later through \ref show_existing_surface, and for HEVC
+     * pictures with \c pic_output_flag equal to 0.
+     */
+    uint32_t        is_shown;
+    /**
+     * \brief Surface to output again, for AV1 \c show_existing_frame.
+     *
+     * When not VAST_INVALID_ID there is nothing to decode: \c target is
+     * left unused, \ref num_slices is zero, and this previously decoded
+     * surface is the next output picture. VAST_INVALID_ID otherwise.
+     */
+    VASTSurfaceID   show_existing_surface;
+    /** \brief Surfaces no longer referenced once this picture is decoded. */
+    VASTSurfaceID   released[VAST_HOST_PARSER_MAX_RELEASED];
+    uint32_t        num_released;
+
+    /** \brief Reserved bytes for future use, must be zero */
+    uint32_t                va_reserved[VAST_PADDING_LOW];
+} VASTHostParsedPicture;
+
+/**
+ * \brief Returns the size of the parser state for a profile.
+ *
+ * The state holds the active parameter sets and the decoded picture
+ * buffer. Its size is fixed per codec, so it can be allocated once, or
+ * placed on the stack or in a pool by the caller. The parser itself
+ * never allocates.
+ *
+ * @param[in] profile           an H.264, HEVC or AV1 profile
+ * @param[out] size             the size in bytes of the parser state
+ */
+VASTStatus
+vastHostParserQueryStateSize(
+    VASTProfile     profile,
+    size_t         *size
+);
+
+/**
+ * \brief Initializes a parser state.
+ *
+ * Also used to reset the parser on a seek.
+ *
+ * @param[in] profile           an H.264, HEVC or AV1 profile
+ * @param[out] state            the caller memory for the parser state
+ * @param[in] state_size        the size of \c state, at least the value
+ *      returned by vastHostParserQueryStateSize()
+ */
+VASTStatus
+vastHostParserInit(
+    VASTProfile     profile,
+    void           *state,
+    size_t          state_size
+);
+
+/**
+ * \brief Parses the headers of one picture into the VAST parameter structures.
+ *
+ * For H.264 and HEVC, \c buf holds one Annex-B access unit, which is
+ * consumed whole. For AV1, \c buf holds low overhead OBUs, and one frame
+ * is parsed per call: a temporal unit may carry several frames, e.g. a
+ * hidden alternate reference followed by a shown frame, or a
+ * \c show_existing_frame header. The caller calls again with the bytes
+ * after \c consumed until the temporal unit is exhausted, giving a new
+ * \c target for each frame to decode.
+ *
+ * Parameter sets found in \c buf are stored in the state, so the
+ * outputs can be passed as is to vastapi_decode_make_param_buffer() and
+ * vastapi_decode_make_slice_buffer() without libavcodec.
+ *
+ * The parser tracks the decoded picture buffer by surface: \c target is
+ * the surface the picture will be decoded to, and reference surfaces in
+ * the picture parameters are those given for earlier pictures. Surfaces
+ * that leave the decoded picture buffer are listed in \c released.
+ *
+ * Possible errors:
+ * - \ref VAST_STATUS_ERROR_MAX_NUM_EXCEEDED: \c slice_params is too
+ *   small, the required number of elements is returned in \c num_slices
+ * - \ref VAST_STATUS_ERROR_DECODING_ERROR: the headers are corrupt or
+ *   refer to a missing parameter set
+ *
+ * @param[in,out] state         the parser state
+ * @param[in] buf               the access unit
+ * @param[in] size              the number of bytes in \c buf
+ * @param[in] target            the surface the picture will be decoded to
+ * @param[in,out] picture       the parsed picture
+ * @param[out] consumed         the number of bytes of \c buf parsed
+ */
+VASTStatus
+vastHostParsePicture(
+    void                   *state,
+    const uint8_t          *buf,
+    size_t                  size,
+    VASTSurfaceID           target,
+    VASTHostParsedPicture  *picture,
+    size_t                 *consumed
+);
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VA_DEC_HOST_H */
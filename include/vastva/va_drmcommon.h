@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2012 Intel Corporation. All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the
+ * "Software"), to deal in the Software without restriction, including
+ * without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sub license, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to
+ * the following conditions:
+ *
+ * The above copyright notice and this permission notice (including the
+ * next paragraph) shall be included in all copies or substantial portions
+ * of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NON-INFRINGEMENT.
+ * IN NO EVENT SHALL INTEL AND/OR ITS SUPPLIERS BE LIABLE FOR
+ * ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+ * TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+ * SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/**
+ * \file va_drmcommon.h
+ * \brief Common definitions for the Linux DRM memory types
+ *
+ * Surfaces can be imported from and exported to DMA-BUF file
+ * descriptors, so that frames move between the device and other
+ * producers or consumers without a host bounce copy.
+ */
+
+#ifndef _VAST_DRMCOMMONAI_H_
+#define _VAST_DRMCOMMONAI_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @name Linux DRM surface memory types */
+/**@{*/
+/** \brief Kernel DRM buffer memory type. */
+#define VAST_SURFACE_ATTRIB_MEM_TYPE_KERNEL_DRM     0x10000000
+/** \brief DRM PRIME memory type (old version).
+ *
+ * This supports only single objects with restricted memory layout.
+ * Used with VASTSurfaceAttribExternalBuffers.
+ */
+#define VAST_SURFACE_ATTRIB_MEM_TYPE_DRM_PRIME      0x20000000
+/** \brief DRM PRIME memory type.
+ *
+ * Used with #VASTDRMPRIMESurfaceDescriptor to import or export
+ * surfaces with any number of objects and layers.
+ */
+#define VAST_SURFACE_ATTRIB_MEM_TYPE_DRM_PRIME_2    0x40000000
+/**@}*/
+
+/** \brief Linear (untiled) DRM format modifier. */
+#define VAST_DRM_FORMAT_MOD_LINEAR                  0ULL
+
+/**
+ * \brief External buffer descriptor for a DRM PRIME surface.
+ *
+ * For export, call vastExportSurfaceHandle() with mem_type set to
+ * #VAST_SURFACE_ATTRIB_MEM_TYPE_DRM_PRIME_2 and pass a pointer to an
+ * instance of this structure to fill.
+ *
+ * For import, call vastCreateSurfaces() with the MemoryType attribute
+ * set to #VAST_SURFACE_ATTRIB_MEM_TYPE_DRM_PRIME_2 and the
+ * ExternalBufferDescriptor attribute set to point to an array of
+ * num_surfaces instances of this structure.
+ *
+ * The returned file descriptors on export are owned by the caller, and
+ * must be closed when no longer needed.
+ */
+typedef struct _VASTDRMPRIMESurfaceDescriptor {
+    /** Pixel format fourcc of the whole surface (VAST_FOURCC_*). */
+    uint32_t fourcc;
+    /** Width of the surface in pixels. */
+    uint32_t width;
+    /** Height of the surface in pixels. */
+    uint32_t height;
+    /** Number of distinct DRM objects making up the surface. */
+    uint32_t num_objects;
+    /** Description of each object. */
+    struct {
+        /** DRM PRIME file descriptor for this object. */
+        int fd;
+        /** Total size of this object (may include regions which are
+         *  not part of the surface). */
+        uint32_t size;
+        /** Format modifier applied to this object. */
+        uint64_t drm_format_modifier;
+    } objects[4];
+    /** Number of layers making up the surface. */
+    uint32_t num_layers;
+    /** Description of each layer in the surface. */
+    struct {
+        /** DRM format fourcc of this layer (DRM_FOURCC_*). */
+        uint32_t drm_format;
+        /** Number of planes in this layer. */
+        uint32_t num_planes;
+        /** Index in the objects array of the object containing each
+         *  plane. */
+        uint32_t object_index[4];
+        /** Offset within the object of each plane. */
+        uint32_t offset[4];
+        /** Pitch of each plane. */
+        uint32_t pitch[4];
+    } layers[4];
+} VASTDRMPRIMESurfaceDescriptor;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _VAST_DRMCOMMONAI_H_ */
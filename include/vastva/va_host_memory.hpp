@@ -0,0 +1,98 @@
+/**
+ * \file va_host_memory.hpp
+ * \brief std::pmr adapter for the host staging memory allocator
+ *
+ * Wraps vastAllocHostMemory()/vastFreeHostMemory() as a
+ * std::pmr::memory_resource, so that C++ containers used for upload
+ * buffers are hugepage-backed and registered for DMA once. Every
+ * allocation goes to the driver, so small objects should go through a
+ * std::pmr::unsynchronized_pool_resource on top of this resource.
+ *
+ * The driver entry points are passed in, as loaded by
+ * vastapi_load_functions() or vastapi_nodev_load_functions(), so the
+ * driver does not have to be linked at build time.
+ */
+
+#ifndef VAST_HOST_MEMORYAI_HPP
+#define VAST_HOST_MEMORYAI_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+
+#include <vastva/va.h>
+
+// Same as in vastapi_dynlink_loader.h, which is not valid C++.
+typedef VASTStatus VastapiAllocHostMemory(size_t size, const VASTHostMemoryAttrib *attrib, void **ptr);
+typedef VASTStatus VastapiFreeHostMemory(void *ptr);
+
+namespace vastva {
+
+class host_memory_resource : public std::pmr::memory_resource {
+public:
+    host_memory_resource(VastapiAllocHostMemory *alloc_fn, VastapiFreeHostMemory *free_fn,
+                         uint32_t flags = VAST_HOST_MEMORY_HUGEPAGE | VAST_HOST_MEMORY_DMA_REGISTER,
+                         int32_t numa_node = VAST_HOST_MEMORY_NUMA_ANY) noexcept
+        : alloc_fn_(alloc_fn), free_fn_(free_fn), attrib_()
+    {
+        attrib_.flags     = flags;
+        attrib_.numa_node = numa_node;
+    }
+
+    const VASTHostMemoryAttrib &attrib() const noexcept { return attrib_; }
+
+private:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        VASTHostMemoryAttrib attrib = attrib_;
+        void *ptr = nullptr;
+
+        // Allocations are aligned to the page size in use, which covers
+        // every alignment the standard containers ask for.  Only raise it
+        // past that page size, zero must keep meaning "page size" so that
+        // hugepage-backed allocations stay hugepage aligned.
+        const std::size_t page_size = (attrib.flags & VAST_HOST_MEMORY_HUGEPAGE) ? hugepage_size : min_page_size;
+        if (alignment > page_size && alignment > attrib.alignment)
+            attrib.alignment = static_cast<uint32_t>(alignment);
+        if (!alloc_fn_ || alloc_fn_(bytes, &attrib, &ptr) != VAST_STATUS_SUCCESS || !ptr)
+            throw std::bad_alloc();
+
+        // A hugepage request falls back to regular pages when no hugepage
+        // is free, which does not meet alignments between the two page
+        // sizes.  Ask for the alignment explicitly then.
+        if (reinterpret_cast<std::uintptr_t>(ptr) % alignment) {
+            if (free_fn_)
+                free_fn_(ptr);
+            ptr = nullptr;
+            attrib.alignment = static_cast<uint32_t>(alignment);
+            if (alloc_fn_(bytes, &attrib, &ptr) != VAST_STATUS_SUCCESS || !ptr)
+                throw std::bad_alloc();
+        }
+        return ptr;
+    }
+
+    void do_deallocate(void *ptr, std::size_t, std::size_t) override
+    {
+        if (free_fn_)
+            free_fn_(ptr);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        const host_memory_resource *o = dynamic_cast<const host_memory_resource *>(&other);
+        return o && o->alloc_fn_ == alloc_fn_ && o->free_fn_ == free_fn_ &&
+               o->attrib_.flags == attrib_.flags && o->attrib_.numa_node == attrib_.numa_node;
+    }
+
+    static constexpr std::size_t min_page_size = 4096;
+    static constexpr std::size_t hugepage_size = 2 * 1024 * 1024;
+
+    VastapiAllocHostMemory *alloc_fn_;
+    VastapiFreeHostMemory  *free_fn_;
+    VASTHostMemoryAttrib    attrib_;
+};
+
+} // namespace vastva
+
+#endif /* VAST_HOST_MEMORYAI_HPP */
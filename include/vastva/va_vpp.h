@@ -263,6 +263,8 @@ typedef enum _VASTProcFilterType {
     VASTProcFilterFlip,
     VASTProcFilterTranspose,
     VASTProcFilterCas,
+    /** \brief HDR to SDR tone mapping. */
+    VASTProcFilterToneMapping,
     /** \brief Number of video filters. */
     VASTProcFilterCount
 } VASTProcFilterType;
@@ -282,6 +284,34 @@ typedef enum _VASTProcDeinterlacingType {
     VASTProcDeinterlacingCount
 } VASTProcDeinterlacingType;
 
+/**
+ * \brief Tone mapping curves.
+ *
+ * #VASTProcFilterToneMapping converts ST_2084 (PQ) or ARIB_B67 (HLG)
+ * input, as given by the \c in_* fields of #FilterParams, to the \c out_*
+ * color properties, typically REC_709_C / REC_709_T / REC_709_M, in a
+ * single device pass. The 3D and 1D LUTs are built once per combination
+ * of input and output color properties and kept in the context. Per-frame
+ * HDR metadata only updates the tone curve.
+ */
+typedef enum _VASTProcToneMappingType {
+    VASTProcToneMappingNone = 0,
+    /** \brief Linear stretch of the reference white. */
+    VASTProcToneMappingLinear,
+    /** \brief Gamma curve. */
+    VASTProcToneMappingGamma,
+    /** \brief Hard clip of out of range values. */
+    VASTProcToneMappingClip,
+    /** \brief Reinhard operator. */
+    VASTProcToneMappingReinhard,
+    /** \brief Hable (filmic) curve. */
+    VASTProcToneMappingHable,
+    /** \brief Mobius curve. */
+    VASTProcToneMappingMobius,
+    /** \brief Number of tone mapping curves. */
+    VASTProcToneMappingCount
+} VASTProcToneMappingType;
+
 /** \brief Color balance types. */
 typedef enum _VASTProcColorBalanceType {
     VASTProcColorBalanceNone = 0,
@@ -406,6 +436,14 @@ typedef struct _VASTBlendState {
  * decoded from a secondary bitstream.
  */
 #define VAST_PROC_PIPELINE_FAST           0x00000002
+/**
+ * \brief Specifies that the overlay comes from the overlay cache.
+ *
+ * When set, #VASTProcFilterOverlay reads the overlay from
+ * VASTProcPipelineParameterBuffer::overlay_surface, as returned by
+ * vastProcOverlayUpload(), and \c overlay_data is ignored.
+ */
+#define VAST_PROC_PIPELINE_OVERLAY_CACHED 0x00000008
 /**@}*/
 
 /** @name Video filter flags */
@@ -717,6 +755,44 @@ typedef enum
   CV_BayerGR
 }CV_BayerType;
 
+/**
+ * \brief Per-frame HDR metadata for tone mapping.
+ *
+ * Carries the mastering display colour volume and the content light
+ * level of the source frame, as found in the HDR10 SEI messages or the
+ * AV1 metadata OBUs.
+ */
+typedef struct _VASTProcHdrMetadata {
+    /** \brief Mastering display colour volume. */
+    VASTHdr10DisplaySei       mastering_display;
+    /** \brief Content light level information. */
+    VASTHdr10LightLevelSei    content_light_level;
+
+    /** \brief Reserved bytes for future use, must be zero */
+    uint32_t                va_reserved[VAST_PADDING_LOW];
+} VASTProcHdrMetadata;
+
+/**
+ * \brief Tone mapping parameters.
+ *
+ * Used by #VASTProcFilterToneMapping. They are kept out of #FilterParams,
+ * which has no reserved space and is allocated by the caller at the
+ * size it was built with.
+ */
+typedef struct _VASTProcToneMappingParams {
+    /** \brief Tone mapping curve. */
+    VASTProcToneMappingType tonemap;
+    /** \brief Curve parameter, 0 for the curve default. */
+    double                  param;
+    /** \brief Highlight desaturation strength. */
+    double                  desat;
+    /** \brief Output peak in nits, 0 for 100. */
+    double                  target_peak;
+
+    /** \brief Reserved bytes for future use, must be zero */
+    uint32_t                va_reserved[VAST_PADDING_LOW];
+} VASTProcToneMappingParams;
+
 typedef struct _VASTProcPipelineParameterBuffer {
     /**
      * \brief Source surface ID.
@@ -897,11 +973,34 @@ typedef struct _VASTProcPipelineParameterBuffer {
 
     VASTProcColorProperties  output_color_properties;
 
+    /**
+     * \brief Cached overlay surface.
+     *
+     * Valid if \ref pipeline_flags has #VAST_PROC_PIPELINE_OVERLAY_CACHED.
+     */
+    VASTSurfaceID         overlay_surface;
+
+    /**
+     * \brief Per-frame HDR metadata.
+     *
+     * Used by #VASTProcFilterToneMapping. If NULL, the mastering display
+     * peak is taken from FilterParams::peak_luminance.
+     */
+    const VASTProcHdrMetadata *hdr_metadata;
+
+    /**
+     * \brief Tone mapping parameters.
+     *
+     * Used by #VASTProcFilterToneMapping. If NULL, the Hable curve is used
+     * with its default parameters.
+     */
+    const VASTProcToneMappingParams *tonemap_params;
+
     /** \brief Reserved bytes for future use, must be zero */
     #if defined(__AMD64__) || defined(__x86_64__) || defined(__amd64__)|| defined(__LP64__)
-    uint32_t                va_reserved[VAST_PADDING_LARGE - 13];
+    uint32_t                va_reserved[VAST_PADDING_LARGE - 18];
     #else
-    uint32_t                va_reserved[VAST_PADDING_LARGE - 11];
+    uint32_t                va_reserved[VAST_PADDING_LARGE - 14];
     #endif
 
 
@@ -1222,6 +1321,327 @@ vastQueryVideoProcPipelineCaps(
     VASTProcPipelineCaps *pipeline_caps
 );
 
+/** \brief Overlay cache statistics. */
+typedef struct _VASTProcOverlayCacheStats {
+    /** \brief Number of overlays resident on the device. */
+    uint32_t        num_overlays;
+    /** \brief Device memory held by resident overlays, in bytes. */
+    uint64_t        bytes_held;
+    /** \brief Memory budget, in bytes. */
+    uint64_t        max_bytes;
+    /** \brief Uploads served from the cache. */
+    uint64_t        hits;
+    /** \brief Uploads that had to be transferred to the device. */
+    uint64_t        misses;
+    /** \brief Overlays evicted to stay under the budget. */
+    uint64_t        evictions;
+
+    /** \brief Reserved bytes for future use, must be zero */
+    uint32_t                va_reserved[VAST_PADDING_LOW];
+} VASTProcOverlayCacheStats;
+
+/**
+ * \brief Sets the device memory budget of the overlay cache.
+ *
+ * Each video processing context owns one overlay cache. When an upload
+ * would exceed \c max_bytes, the least recently used overlays are
+ * evicted first. Lowering the budget evicts immediately. A budget of
+ * zero disables the cache and evicts everything.
+ *
+ * @param[in] dpy               the VA display
+ * @param[in] context           the video processing context
+ * @param[in] max_bytes         the budget in bytes
+ */
+VASTStatus
+vastProcOverlayCacheSetBudget(
+    VASTDisplay           dpy,
+    VASTContextID         context,
+    uint64_t            max_bytes
+);
+
+/**
+ * \brief Uploads an RGBA overlay into the overlay cache.
+ *
+ * The overlay is keyed by a hash of its content. If an identical overlay
+ * is already resident, its surface is returned and marked as most
+ * recently used, and no transfer takes place. Otherwise the overlay is
+ * transferred to the device once.
+ *
+ * The returned surface is then referenced from
+ * VASTProcPipelineParameterBuffer::overlay_surface with
+ * #VAST_PROC_PIPELINE_OVERLAY_CACHED set. Rendering with a surface that
+ * was evicted returns #VAST_STATUS_ERROR_INVALID_SURFACE, and the overlay
+ * shall be uploaded again.
+ *
+ * @param[in] dpy               the VA display
+ * @param[in] context           the video processing context
+ * @param[in] data              the RGBA pixels
+ * @param[in] width             the overlay width in pixels
+ * @param[in] height            the overlay height in pixels
+ * @param[in] pitch             the scanline pitch of \c data in bytes
+ * @param[out] overlay          the cached overlay surface
+ */
+VASTStatus
+vastProcOverlayUpload(
+    VASTDisplay           dpy,
+    VASTContextID         context,
+    const void         *data,
+    uint32_t            width,
+    uint32_t            height,
+    uint32_t            pitch,
+    VASTSurfaceID        *overlay
+);
+
+/**
+ * \brief Evicts an overlay from the overlay cache.
+ *
+ * The device memory is released once pending renders that reference
+ * the overlay have completed.
+ *
+ * @param[in] dpy               the VA display
+ * @param[in] context           the video processing context
+ * @param[in] overlay           the cached overlay surface
+ */
+VASTStatus
+vastProcOverlayEvict(
+    VASTDisplay           dpy,
+    VASTContextID         context,
+    VASTSurfaceID         overlay
+);
+
+/**
+ * \brief Queries the overlay cache statistics.
+ *
+ * @param[in] dpy               the VA display
+ * @param[in] context           the video processing context
+ * @param[out] stats            the cache statistics
+ */
+VASTStatus
+vastProcOverlayCacheQuery(
+    VASTDisplay                 dpy,
+    VASTContextID               context,
+    VASTProcOverlayCacheStats  *stats
+);
+
+/** @name Host filter instruction sets */
+/**@{*/
+/** \brief Use the widest instruction set supported by the running CPU. */
+#define VAST_PROC_HOST_ISA_AUTO           0x00000000
+/** \brief Portable C path. This is the golden reference for the other paths. */
+#define VAST_PROC_HOST_ISA_C              0x00000001
+/** \brief x86-64 AVX2 path. */
+#define VAST_PROC_HOST_ISA_AVX2           0x00000002
+/** \brief AArch64 NEON path. */
+#define VAST_PROC_HOST_ISA_NEON           0x00000004
+/** \brief x86-64 AVX-512 (F, BW) path. */
+#define VAST_PROC_HOST_ISA_AVX512         0x00000008
+/**@}*/
+
+/** \brief Frame in host memory processed by the host filters. */
+typedef struct _VASTProcHostFrame {
+    /** \brief Pixel format of the frame. */
+    VAST_PIX_FTM    pix_fmt;
+    /** \brief Width in pixels. */
+    uint32_t        width;
+    /** \brief Height in pixels. */
+    uint32_t        height;
+    /** \brief Number of planes, can not be greater than 3. */
+    uint32_t        num_planes;
+    /** \brief Scanline pitch in bytes for each plane. */
+    uint32_t        pitches[3];
+    /** \brief Start address of each plane. */
+    uint8_t        *planes[3];
+
+    /** \brief Reserved bytes for future use, must be zero */
+    uint32_t                va_reserved[VAST_PADDING_LOW];
+} VASTProcHostFrame;
+
+/**
+ * \brief Queries the filters available on the host.
+ *
+ * The host filters are CPU implementations of the device filters. They
+ * are driven by the same #FilterParams structure and are meant to be used
+ * as golden references for device output, or as a fallback when no die
+ * is available. #VASTProcFilterOverlay has no host implementation.
+ *
+ * @param[out] filters          the output array of #VASTProcFilterType elements
+ * @param[in,out] num_filters   the number of elements allocated on input,
+ *      the number of elements actually filled in on output
+ * @param[out] isa_flags        the host instruction sets usable on this CPU,
+ *      see "Host filter instruction sets"
+ */
+VASTStatus
+vastProcHostQueryFilters(
+    VASTProcFilterType   *filters,
+    unsigned int       *num_filters,
+    uint32_t           *isa_flags
+);
+
+/**
+ * \brief Creates the state of a temporal host filter.
+ *
+ * Temporal filters, e.g. the \c luma_temporal and \c chroma_temporal
+ * pass of #VASTProcFilterHQDN3D, carry the previous frame over to the
+ * next call of vastProcHostRender(). Like the device, the state is
+ * seeded by the first frame rendered with it. To restart a sequence,
+ * e.g. on a seek, destroy the state and create a new one.
+ *
+ * @param[in] filt_params       the filter parameters
+ * @param[in] width             the width of the frames in pixels
+ * @param[in] height            the height of the frames in pixels
+ * @param[out] state            the filter state
+ */
+VASTStatus
+vastProcHostStateCreate(
+    const FilterParams       *filt_params,
+    uint32_t                width,
+    uint32_t                height,
+    void                  **state
+);
+
+VASTStatus
+vastProcHostStateDestroy(
+    void                   *state
+);
+
+/**
+ * \brief Runs a filter on the host.
+ *
+ * The filter type and its parameters are taken from \c filt_params, as
+ * filled in by vastFilterParamInit() and vastFilterParamParse(). Filters
+ * producing several outputs (e.g. #VASTProcFilterScale with
+ * \c nb_outputs > 1) write one frame per element of \c dst.
+ *
+ * Temporal filters need the \c state created by
+ * vastProcHostStateCreate(), with the frames passed in display order.
+ * Other filters ignore it and accept NULL. Passing NULL to a temporal
+ * filter fails with \ref VAST_STATUS_ERROR_INVALID_PARAMETER.
+ *
+ * The \c VAST_PROC_HOST_ISA_C path is bit-exact with the device for
+ * integer filters. For temporal filters this holds when the host state
+ * and the device context are fed the same frame sequence. The SIMD
+ * paths are bit-exact with the C path.
+ *
+ * Possible errors:
+ * - \ref VAST_STATUS_ERROR_UNSUPPORTED_FILTER: the filter has no host
+ *   implementation
+ * - \ref VAST_STATUS_ERROR_INVALID_IMAGE_FORMAT: the pixel format is not
+ *   accepted by the filter
+ * - \ref VAST_STATUS_ERROR_FLAG_NOT_SUPPORTED: \c isa is not supported
+ *   by the running CPU
+ *
+ * @param[in] filt_params       the filter parameters
+ * @param[in,out] state         the filter state, NULL for non-temporal filters
+ * @param[in] src               the source frame
+ * @param[out] dst              the array of destination frames, allocated
+ *      by the caller
+ * @param[in] num_dst           the number of elements in \c dst
+ * @param[in] isa               one of the "Host filter instruction sets"
+ */
+VASTStatus
+vastProcHostRender(
+    const FilterParams       *filt_params,
+    void                     *state,
+    const VASTProcHostFrame  *src,
+    VASTProcHostFrame        *dst,
+    unsigned int            num_dst,
+    uint32_t                isa
+);
+
+/**
+ * \brief Compares two frames plane by plane.
+ *
+ * Used to check device output against the host filters. Both frames
+ * shall have the same pixel format and size. A PSNR of \c INFINITY
+ * together with a zero \c max_diff means the frames are bit-exact.
+ *
+ * @param[in] ref               the reference frame
+ * @param[in] test              the frame under test
+ * @param[out] psnr             the PSNR of each plane, 3 elements
+ * @param[out] max_diff         the maximum absolute sample difference
+ *      of each plane, 3 elements
+ */
+VASTStatus
+vastProcHostCompare(
+    const VASTProcHostFrame  *ref,
+    const VASTProcHostFrame  *test,
+    double                 *psnr,
+    uint32_t               *max_diff
+);
+
+/**
+ * \brief Queries the host pixel format conversion between two formats.
+ *
+ * Returns \ref VAST_STATUS_ERROR_INVALID_IMAGE_FORMAT if there is no
+ * conversion from \c src_fmt to \c dst_fmt.
+ *
+ * @param[in] src_fmt           the source pixel format
+ * @param[in] dst_fmt           the destination pixel format
+ * @param[out] isa_flags        the instruction sets implementing this
+ *      conversion on this CPU, see "Host filter instruction sets"
+ */
+VASTStatus
+vastProcHostConvertQuery(
+    VAST_PIX_FTM          src_fmt,
+    VAST_PIX_FTM          dst_fmt,
+    uint32_t           *isa_flags
+);
+
+/**
+ * \brief Converts a frame between pixel formats on the host.
+ *
+ * Covers the conversions between the upload formats the device accepts
+ * (planar and packed YUV 4:2:0/4:2:2, 10-bit YUV, RGB variants and
+ * Bayer) and the formats the encoder consumes (NV12, P010, Y210).
+ * Source and destination must have the same size. All pitches are
+ * honoured, so \c dst may point straight into a mapped DMA staging
+ * buffer such as VASTAPIDmaHandle::dmabuff_viraddr. Large destinations
+ * are written with non-temporal stores.
+ *
+ * @param[in] src               the source frame
+ * @param[out] dst              the destination frame, allocated by the caller
+ * @param[in] isa               one of the "Host filter instruction sets"
+ */
+VASTStatus
+vastProcHostConvert(
+    const VASTProcHostFrame  *src,
+    VASTProcHostFrame        *dst,
+    uint32_t                isa
+);
+
+/**
+ * \brief Synthesizes and applies AV1 film grain on the host.
+ *
+ * Takes the film grain parameters exactly as carried in
+ * #VASTDecPictureParameterBufferAV1, e.g. to decode without grain for
+ * analytics and add it back on display, or to apply it after scaling.
+ * The grain template, the pseudo-random generator and the block overlap
+ * follow section 7.18.3 of the AV1 specification, so the output matches
+ * the reference decoder bit for bit on every instruction set.
+ *
+ * Frames shall be NV12 or P010, typically surfaces mapped with
+ * vastDeriveImage() and vastMapBuffer(). \c dst may be equal to \c src.
+ * Nothing is done when \c apply_grain is not set.
+ *
+ * Possible errors:
+ * - \ref VAST_STATUS_ERROR_INVALID_IMAGE_FORMAT: the pixel format is
+ *   not NV12 or P010
+ * - \ref VAST_STATUS_ERROR_FLAG_NOT_SUPPORTED: \c isa is not supported
+ *   by the running CPU
+ *
+ * @param[in] film_grain        the film grain parameters of the frame
+ * @param[in] src               the source frame
+ * @param[out] dst              the destination frame, allocated by the caller
+ * @param[in] isa               one of the "Host filter instruction sets"
+ */
+VASTStatus
+vastProcHostApplyFilmGrain(
+    const VASTFilmGrainStructAV1  *film_grain,
+    const VASTProcHostFrame  *src,
+    VASTProcHostFrame        *dst,
+    uint32_t                isa
+);
+
 /**@}*/
 
 #ifdef __cplusplus
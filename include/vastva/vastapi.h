@@ -8,7 +8,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-#include <vastva/va_public.h>
+#include <vastva/va.h>
+#include <vastva/va_drmcommon.h>
 
 #define MAX_ADAPTIVE_GOP_SIZE 8
 
@@ -178,6 +179,9 @@ typedef struct VASTAPIEncodePicture {
     int64_t             dts_internal;
     int                 ctnIgop;
     void *reserved;
+    // Fence of the asynchronous upload of input_surface, or NULL.  The
+    // encode is queued behind it instead of blocking the host.
+    struct VASTAPIFence_s *input_fence;
 } VASTAPIEncodePicture;
 
 
@@ -634,10 +638,81 @@ void v_queue_free(struct queue *queue);
 #ifndef __VADEC_API_H_
 #define __VADEC_API_H_
 
+#include <vastva/va_vpp.h>
+#include <vastva/va_dec_host.h>
+
 enum {
     MAX_PARAM_BUFFERS = 16,
 };
 
+// Decoder skip modes.  vastapi_decode_skip_picture() is called with the
+// reference and key frame flags of each picture before its buffers are
+// built.  It returns zero or a negative error code like the other
+// vastapi_decode_* calls, and sets *skip when the picture must be
+// dropped.
+enum VASTAPIDecSkipMode {
+    VASTAPI_DEC_SKIP_NONE,
+    // Drop pictures not used for reference.
+    VASTAPI_DEC_SKIP_NONREF,
+    // Decode IDR/IRAP pictures and AV1 key frames only.
+    VASTAPI_DEC_SKIP_NONKEY,
+};
+
+typedef struct VASTAPIDecPoolConfig_s {
+    // The pool never shrinks below min_surfaces; max_surfaces of zero
+    // means no upper bound.
+    int          min_surfaces;
+    int          max_surfaces;
+    // Surfaces are only reused for requests of the same rt_format; an
+    // rt_format of zero in vastapi_dec_pool_get() selects the format of
+    // the decoder context.
+    // A free surface is reused for a smaller request if it is at least
+    // as wide and as tall as requested, and its area exceeds the
+    // requested one by at most size_slack percent.
+    int          size_slack;
+    // Idle surfaces above min_surfaces are destroyed after this many
+    // decoded pictures without being handed out.
+    int          shrink_delay;
+} VASTAPIDecPoolConfig;
+
+typedef struct VASTAPIDecPoolStats_s {
+    uint64_t     hits;
+    uint64_t     misses;
+    unsigned int nb_surfaces;
+    unsigned int nb_in_use;
+} VASTAPIDecPoolStats;
+
+// Scheduling of the streams of a decode multiplexer.
+enum VASTAPIDecMuxSchedule {
+    VASTAPI_DEC_MUX_ROUND_ROBIN,
+    // Highest priority first, round-robin among equal priorities.
+    VASTAPI_DEC_MUX_PRIORITY,
+};
+
+typedef struct VASTAPIDecMuxConfig_s {
+    // All streams share this profile and fit in max_width x max_height.
+    VASTProfile  profile;
+    int          max_width;
+    int          max_height;
+    int          max_streams;
+    // One of VASTAPIDecMuxSchedule.
+    int          schedule;
+    // Decoded pictures held per stream before its submissions block.
+    int          queue_depth;
+    // Surface pool shared by all the streams.
+    VASTAPIDecPoolConfig pool;
+} VASTAPIDecMuxConfig;
+
+// Packed slice buffers, see vastapi_decode_append_slice().  All slice
+// parameters of a picture go into param_buffer and all its slice data
+// into data_buffer.  Buffers are VAST_INVALID_ID until first used, and
+// are recreated larger when a picture no longer fits.
+typedef struct VASTAPIDecSliceBuffers_s {
+    VASTBufferID  param_buffer;
+    VASTBufferID  data_buffer;
+    size_t        param_size;
+    size_t        data_size;
+} VASTAPIDecSliceBuffers;
 
 typedef struct _VASTVADecCtx{
     VASTConfigID  va_config;
@@ -647,8 +722,77 @@ typedef struct _VASTVADecCtx{
 
     VASTSurfaceAttrib pixel_format_attribute;
 
+    // Decoder surface pool from vastapi_dec_pool_create(), NULL to use the
+    // fixed render targets of vastapi_create_dec_context().  Contexts on
+    // the same die may share one pool.
+    void*       surface_pool;
+
+    // Pictures vastapi_decode_picture_async() keeps in flight before it
+    // blocks; zero or one keeps the synchronous behaviour.  Set before
+    // vastapi_create_dec_context().
+    int         async_depth;
+    // eventfd signalled each time a queued picture completes, -1 when
+    // async decode is off.  Filled by vastapi_create_dec_context().
+    int         event_fd;
+
+    // Packed slice buffers, one entry per picture in flight, i.e.
+    // async_depth entries or one for synchronous decode.  Allocated by
+    // vastapi_create_dec_context() and freed by vastapi_decode_uninit().
+    // An entry is handed out again only once the picture using it has
+    // completed, so the device never reads a buffer being refilled.
+    VASTAPIDecSliceBuffers *slice_ring;
+    int         nb_slice_ring;
+    int         slice_ring_head;
+
+    // One of VASTAPIDecSkipMode.  Set before vastapi_create_dec_config(),
+    // the DPB size of the context is reduced accordingly.
+    int         skip_mode;
+
+    // Decode multiplexer the context was added to with
+    // vastapi_dec_mux_add_stream(), NULL for a standalone context.
+    // va_config, va_context and surface_pool then belong to the
+    // multiplexer: vastapi_decode_uninit() and vastapi_destroy_config()
+    // check mux, detach the stream as vastapi_dec_mux_remove_stream()
+    // would and leave the shared objects alone.  They are destroyed by
+    // vastapi_dec_mux_destroy(), to be called once every stream has been
+    // removed or uninitialized.
+    void*       mux;
+
 } VASTVADecCtx;
 
+typedef struct VASTAPIJpegBatchItem {
+    // One baseline JPEG image, SOI to EOI.
+    const uint8_t *data;
+    size_t         size;
+    // Surface the image is decoded to, taken from the surface_pool of
+    // the decoder context at the image size and format: 4:2:0, 4:2:2,
+    // 4:4:4 and grayscale images can be mixed in one batch.  Set on
+    // submission.
+    VASTSurfaceID  output_surface;
+    int            width;
+    int            height;
+    // VAST_RT_FORMAT_YUV420, _YUV422, _YUV444 or _YUV400, and the
+    // matching pixel format of output_surface.
+    unsigned int   rt_format;
+    VAST_PIX_FTM   pix_fmt;
+    // Result of this item, set once the batch has completed.
+    VASTStatus     status;
+} VASTAPIJpegBatchItem;
+
+// Input of vastapi_decode_jpeg_batch().  The decoder context must have
+// a surface_pool; with a NULL surface_pool the call fails with a
+// negative error code and submits nothing.
+typedef struct VASTAPIJpegBatch {
+    VASTAPIJpegBatchItem *items;
+    int                   nb_items;
+    // Set on submission.  Synced once for the whole batch.
+    VASTSurfaceID         sync_surface;
+    // Distinct Huffman and quantization table sets uploaded for the
+    // batch.  Identical tables are found by hash and uploaded once.
+    int                   nb_huffman_tables;
+    int                   nb_iq_matrices;
+} VASTAPIJpegBatch;
+
 typedef struct VASTAPIDecodePicture {
     VASTSurfaceID output_surface;
 
@@ -658,6 +802,14 @@ typedef struct VASTAPIDecodePicture {
     int           nb_slices;
     VASTBufferID *slice_buffers;
     int           slices_allocated;
+
+    // Packed slices, see vastapi_decode_append_slice().  Index plus one
+    // of the slice_ring entry of the decoder context used by this
+    // picture, so that a zero-filled picture uses the per-slice buffers.
+    int           slice_ring_slot;
+    // Bytes of each buffer of that entry used by this picture.
+    size_t        slice_param_offset;
+    size_t        slice_data_offset;
 } VASTAPIDecodePicture;
 
 #endif // __VADEC_API_H_
@@ -685,6 +837,27 @@ typedef struct VASTAPIDmaHandle_s {
     unsigned int data_size;
 } VASTAPIDmaHandle;
 
+#define VASTAI_DMA_POOL_SIZE_CLASSES 16
+
+typedef struct VASTAPIDmaPoolConfig_s {
+    // Upper bound in bytes of each size class, ascending, unused entries
+    // zero.  All zero selects power-of-two classes from 64 KiB to 2 GiB.
+    unsigned int class_size[VASTAI_DMA_POOL_SIZE_CLASSES];
+    // Once the pool holds more than high_watermark bytes, idle handles are
+    // released, largest classes first, until low_watermark is reached.
+    uint64_t     high_watermark;
+    uint64_t     low_watermark;
+} VASTAPIDmaPoolConfig;
+
+typedef struct VASTAPIDmaPoolStats_s {
+    uint64_t     hits;
+    uint64_t     misses;
+    uint64_t     bytes_held;
+    uint64_t     bytes_in_use;
+    unsigned int handles_held;
+    unsigned int handles_in_use;
+} VASTAPIDmaPoolStats;
+
 typedef struct AVVASTAPIDeviceContext_s {
     VASTDisplay display;
     void*       vst_func;
@@ -716,6 +889,10 @@ typedef struct VASTAPIDeviceContext_s {
     // Surface formats which can be used with this device.
     VASTAPISurfaceFormat *formats;
     int                   nb_formats;
+    // NUMA node local to the die, filled at device init.  DMA staging
+    // memory of the frame contexts is allocated on it.  Set to
+    // VAST_HOST_MEMORY_NUMA_ANY to disable the placement.
+    int                   numa_node;
 } VASTAPIDeviceContext;
 
 
@@ -744,11 +921,67 @@ typedef struct VASTAPIFramesContext_s {
     int              number_dmabuffer;
     int              buffer_elem_size;
     int              dma_hack_enable;
+    // Take DMA handles from the per-die size-classed pool shared by all
+    // frame contexts instead of pool_dmabuffer.  VASTAI_DMA_BUFFER_MAX
+    // does not apply then.
+    int              use_die_dma_pool;
+
+    // Keep one VASTImage per pool surface (derived, or created when
+    // derive_works is 0) across map/unmap calls.  Only the image
+    // create/derive and destroy are cached: a created image is still
+    // filled with vastGetImage() on every read map and written back with
+    // vastPutImage() on every write unmap.  The cached images are
+    // destroyed by vastapi_map_cache_invalidate() or with the frames
+    // context, e.g. when the pool is reconfigured.
+    int              map_cache_enable;
+    void            *map_cache;
 } VASTAPIFramesContext;
 
+// Returned by vastapi_transfer_data_async().  The host data passed to
+// that call is read by the DMA engine after the call returns, so it must
+// stay valid and unmodified until the fence signals.
+typedef struct VASTAPIFence_s {
+    // Die whose transfer queue issued the fence.
+    int      die_id;
+    // Position of the transfer in that queue.  Signalled once every
+    // transfer up to and including seqno has completed.
+    uint64_t seqno;
+} VASTAPIFence;
+
+typedef struct VASTAPIDmaBufImport_s {
+    // Layout of the external buffer: fds, per-plane offsets and pitches.
+    VASTDRMPRIMESurfaceDescriptor desc;
+    // Called once the imported surface has been released and the device
+    // no longer accesses the buffer, so the producer can reuse it.
+    void (*release)(void *opaque);
+    void  *opaque;
+} VASTAPIDmaBufImport;
+
+typedef struct VASTAPIDmaBufExport_s {
+    VASTSurfaceID surface;
+    // Filled by the export: fds, per-plane offsets and pitches, fourcc
+    // and format modifier.  The fds are closed on release.
+    VASTDRMPRIMESurfaceDescriptor desc;
+    // Signalled once the producer has finished writing the surface.  The
+    // consumer waits on it before reading, -1 if already complete.
+    int acquire_fence;
+} VASTAPIDmaBufExport;
+
+// Input of vastapi_transfer_frame_sg().  The scatter-gather list built
+// from it is internal to the driver.
+typedef struct VASTAPITransferPlanes_s {
+    // Host planes of the frame, as in AVFrame.data/linesize.
+    uint8_t *data[4];
+    int      linesize[4];
+    int      nb_planes;
+} VASTAPITransferPlanes;
+
 typedef struct VASTAPIMapping_s {
     VASTImage image;
     int flags;
+    // The image belongs to the mapping cache and is not destroyed on
+    // unmap.
+    int cached;
 } VASTAPIMapping;
 
 
@@ -797,14 +1030,94 @@ typedef struct VASTAPIPsnrCmd{
 #define VAFILTER_API_H
 
 #include <vastva/va_vpp.h>
+
+#define VASTAPI_REF_RING_MAX 8
+
+// Returned, instead of 0, by vastfilter_render_picture() when no output
+// was written because the ring is still filling, and by
+// vastfilter_ref_ring_flush() once the ring is empty.  Errors stay
+// negative.
+#define VASTAPI_FILTER_NO_OUTPUT 1
+
+// Temporal reference ring of a filter context.  With nb_backward > 0 the
+// output for an input is written once nb_backward later inputs have been
+// rendered, so vastfilter_render_picture() returns
+// VASTAPI_FILTER_NO_OUTPUT for the first nb_backward inputs.  At end of
+// stream, call vastfilter_ref_ring_flush() until it returns
+// VASTAPI_FILTER_NO_OUTPUT; each call writes the output of one pending
+// input, at most nb_backward in total.
+typedef struct VASTAPIRefRing {
+    // Number of past and future input surfaces wired into each render as
+    // forward_references/backward_references.  Zero for both disables
+    // the ring.
+    int nb_forward;
+    int nb_backward;
+
+    // Retained input frames in input order, oldest at head.
+    VASTSurfaceID surfaces[VASTAPI_REF_RING_MAX];
+    void/*AVFrame*/ *frames[VASTAPI_REF_RING_MAX];
+    int           nb_entries;
+    int           head;
+
+    // Input frame the output just written belongs to; its pts and
+    // properties apply to the output.  Set whenever render or flush
+    // returns 0, and valid until the next call on the ring.
+    void/*AVFrame*/ *output_frame;
+
+    // Take and drop a reference on an input frame, so that surfaces held
+    // by the ring are not returned to the pool while still referenced.
+    // Required when the ring is enabled, and must be set before
+    // vastfilter_ref_ring_init(), which keeps them and only resets the
+    // entries.
+    void *(*frame_ref)(void *frame);
+    void  (*frame_unref)(void **frame);
+} VASTAPIRefRing;
+
+typedef struct VASTAPIFilterBatchItem {
+    VASTSurfaceID  input_surface;
+    // Output surfaces of this item, at most 64 as in
+    // VASTProcPipelineParameterBuffer.output_surface.
+    VASTSurfaceID *output_surfaces;
+    int            nb_outputs;
+    // Per-item parameters.  NULL uses the filt_params of the filter
+    // context.
+    FilterParams  *filt_params;
+    // Result of this item, set once the batch has completed.
+    VASTStatus     status;
+} VASTAPIFilterBatchItem;
+
+typedef struct VASTAPIFilterBatch {
+    VASTAPIFilterBatchItem *items;
+    int                     nb_items;
+    // Set on submission.  Synced once for the whole batch.
+    VASTSurfaceID           sync_surface;
+} VASTAPIFilterBatch;
+
+// Bound of VASTFilterParamer.filter_buffers, VASTProcFilterCount before
+// #VASTProcFilterToneMapping was added.  Fixed, as the struct is shared
+// with the driver; filters added since have their own buffer at the end.
+#define VASTAPI_FILTER_BUFFERS_MAX 20
+
 typedef struct _VASTVAFilter{
     VASTConfigID                            va_config;
     VASTContextID                           va_context;
     VASTSurfaceID                           va_surface;
-    VASTBufferID                            filter_buffers[VASTProcFilterCount];
+    VASTBufferID                            filter_buffers[VASTAPI_FILTER_BUFFERS_MAX];
     AVVASTAPIDeviceContext                  *hwctx;
     FilterParams                            *filt_params;
     VASTProcPipelineParameterBuffer         pipeline_params;
+
+    // Frame owning pipeline_params.surface, retained by ref_ring.
+    void/*AVFrame*/                         *input_frame;
+    // Temporal references for deinterlacing and HQDN3D.  With
+    // nb_backward > 0 output lags input by nb_backward frames, see VASTAPIRefRing.
+    VASTAPIRefRing                          ref_ring;
+
+    // Filter buffer of VASTProcFilterToneMapping.
+    VASTBufferID                            tonemap_buffer;
+    // Tone mapping parameters, set by the caller.  pipeline_params
+    // .tonemap_params points here when the filter is tone mapping.
+    VASTProcToneMappingParams               tonemap_params;
 }VASTFilterParamer;
 
 #endif // VAFILTER_API_H
@@ -163,13 +163,28 @@ typedef void  VastapiHwDmaBuffFree(void *opaque, VASTAPIDmaHandle *data);
 typedef void  VastapiHwBuffFree(void *opaque, uint8_t *data);
 typedef void  VastapiHwUnmapFrame(VASTAPIContext *vstCtx, void* data, int width, int height);
 typedef int   VastapiHwMapFrame(VASTAPIContext *vstCtx, VAST_PIX_FTM dstFtm, int width, int height, int flags);
+typedef void  VastapiHwMapCacheInvalidate(VASTAPIContext *vstCtx);
 typedef int   VastapiHwGetConstraints(VASTAPIContext *vstCtx, VastapiConstraint *constraints, VASTSurfaceAttrib **attr_list);
 typedef int   VastapiHwSurfaceAddr(AVVASTAPIDeviceContext *hwctx, uint8_t *data, uint64_t *frame_addr, int isGetAddress);
 typedef int   VastapiHwSurfaceAddrFromFd(AVVASTAPIDeviceContext *hwctx, uint8_t *data, int dmabuf_fd);
+typedef int   VastapiHwSurfaceImportDmaBuf(AVVASTAPIDeviceContext *hwctx, const VASTAPIDmaBufImport *import, VASTSurfaceID *surface);
+typedef void  VastapiHwSurfaceImportRelease(AVVASTAPIDeviceContext *hwctx, VASTSurfaceID surface);
+typedef int   VastapiHwSurfaceExportDmaBuf(AVVASTAPIDeviceContext *hwctx, VASTSurfaceID surface, uint32_t flags, VASTAPIDmaBufExport *export_desc);
+typedef void  VastapiHwSurfaceExportRelease(AVVASTAPIDeviceContext *hwctx, VASTAPIDmaBufExport *export_desc, int release_fence);
 typedef int   VastapiHwTransferData(VASTAPIContext *vstCtx, uint64_t dma_addr, int dma_size, uint8_t *data, int fd, int src_type, int isHostToHw);
+typedef int   VastapiHwTransferFrameSg(VASTAPIContext *vstCtx, uint64_t dma_addr, const VASTAPITransferPlanes *planes,
+                                       VAST_PIX_FTM pix_fmt, int width, int height);
+typedef int   VastapiHwTransferQueueInit(AVVASTAPIDeviceContext *hwctx, int depth);
+typedef int   VastapiHwTransferDataAsync(VASTAPIContext *vstCtx, uint64_t dma_addr, int dma_size, uint8_t *data, int fd, int src_type,
+                                         VASTAPIFence *fence);
+typedef int   VastapiHwFenceWait(AVVASTAPIDeviceContext *hwctx, const VASTAPIFence *fence, int timeout_ms);
 typedef int   VastapiHwFrameInit(VASTAPIContext *vstCtx, VAST_PIX_FTM pix_fmt, int pool_size, int frame_flags);
 typedef int   VastapiHwTestDeriveWork(VASTAPIContext *vstCtx, VAST_PIX_FTM pix_fmt, uint8_t *data);
 typedef VASTAPIDmaHandle*  VastapiHwAllocDmaBuff(VASTAPIContext *vstCtx);
+typedef int   VastapiHwDmaPoolInit(AVVASTAPIDeviceContext *hwctx, const VASTAPIDmaPoolConfig *config);
+typedef VASTAPIDmaHandle*  VastapiHwDmaPoolGet(AVVASTAPIDeviceContext *hwctx, unsigned int size);
+typedef void  VastapiHwDmaPoolPut(AVVASTAPIDeviceContext *hwctx, VASTAPIDmaHandle *handle);
+typedef int   VastapiHwDmaPoolStats(AVVASTAPIDeviceContext *hwctx, VASTAPIDmaPoolStats *stats);
 
 
 //vastapi decoder api
@@ -186,6 +201,23 @@ typedef int   VastapiDecSyncSurface(VASTVADecCtx *vaCtx, VASTSurfaceID surface_i
 typedef int   VastapiDecCreateContext(VASTVADecCtx *vaCtx, int width, int height, int flag, VASTSurfaceID *render_targets,int num_render);
 typedef int   VastapiDecDestoryConfig(VASTVADecCtx *vaCtx);
 typedef VAST_PIX_FTM VastapiDecGetFmt(VASTSurfaceAttrib attr);
+typedef int   VastapiDecPoolCreate(AVVASTAPIDeviceContext *hwctx, const VASTAPIDecPoolConfig *config, void **pool);
+typedef void  VastapiDecPoolDestroy(void *pool);
+typedef int   VastapiDecPoolGet(VASTVADecCtx *vaCtx, int width, int height, unsigned int rt_format, VASTSurfaceID *surface_id);
+typedef void  VastapiDecPoolPut(VASTVADecCtx *vaCtx, VASTSurfaceID surface_id);
+typedef int   VastapiDecPoolStats(void *pool, VASTAPIDecPoolStats *stats);
+typedef int   VastapiDecReconfigure(VASTVADecCtx *vaCtx, int width, int height, int num_render);
+typedef int   VastapiDecPictureAsync(VASTVADecCtx *vaCtx, VASTAPIDecodePicture *pic);
+typedef int   VastapiDecPoll(VASTVADecCtx *vaCtx, VASTSurfaceID *surface_id, int timeout_ms);
+typedef int   VastapiDecSkipPicture(VASTVADecCtx *vaCtx, int is_reference, int is_keyframe, int *skip);
+typedef int   VastapiDecMuxCreate(AVVASTAPIDeviceContext *hwctx, const VASTAPIDecMuxConfig *config, void **mux);
+typedef void  VastapiDecMuxDestroy(void *mux);
+typedef int   VastapiDecMuxAddStream(void *mux, VASTVADecCtx *vaCtx, int priority);
+typedef void  VastapiDecMuxRemoveStream(void *mux, VASTVADecCtx *vaCtx);
+typedef int   VastapiDecJpegBatch(VASTVADecCtx *vaCtx, VASTAPIJpegBatch *batch);
+typedef int   VastapiDecSyncJpegBatch(VASTVADecCtx *vaCtx, VASTAPIJpegBatch *batch);
+typedef int   VastapiDecAppendSlice(VASTVADecCtx *vaCtx, VASTAPIDecodePicture *pic, const void *params_data,
+                                    size_t params_size, const void *slice_data, size_t slice_size);
 
 
 //vastapi filter  api
@@ -193,6 +225,11 @@ typedef void  VastapiFilterPipelineUnint(VASTFilterParamer *vastfilter_params,in
 typedef int  VastapiFilterRenderPicture(VASTFilterParamer *vastfilter_params);
 typedef int VastapiFilterConfigCreate(VASTFilterParamer *vastfilter_params);
 typedef int VastapiFilterContextCreate(VASTFilterParamer *vastfilter_params,uint32_t output_width,uint32_t output_height,AVVASTAPIFramesContext *va_frames);
+typedef int  VastapiFilterRefRingInit(VASTFilterParamer *vastfilter_params, int nb_forward, int nb_backward);
+typedef int  VastapiFilterRefRingFlush(VASTFilterParamer *vastfilter_params);
+typedef void VastapiFilterRefRingUninit(VASTFilterParamer *vastfilter_params);
+typedef int  VastapiFilterRenderBatch(VASTFilterParamer *vastfilter_params, VASTAPIFilterBatch *batch);
+typedef int  VastapiFilterSyncBatch(VASTFilterParamer *vastfilter_params, VASTAPIFilterBatch *batch);
 
 
 //vastapi api
@@ -222,9 +259,42 @@ typedef void       VastapiFilterParamInit(void * filt_params);
 typedef VASTStatus VastapiFilterParamParse(void * filt_params, const char * key,const char * value);
 typedef VASTStatus vastapiDeviceMemcpy(VASTDisplay dpy,uint32_t dev_id, const void *addr_from, size_t size, void *addr_to,int direction,void *dma_handle);
 typedef VASTStatus VastapiGetDieinfo(VASTDisplay dpy,int* die_id);
+typedef VASTStatus VastapiQueryPeerAccess(VASTDisplay src_dpy, VASTDisplay dst_dpy, int *p2p_supported);
+typedef VASTStatus VastapiCopySurfacePeer(VASTDisplay src_dpy, VASTSurfaceID src_surface, VASTDisplay dst_dpy, VASTSurfaceID dst_surface,
+                                          uint32_t flags);
+typedef VASTStatus VastapiQueryDieTopology(VASTDisplay dpy, int die_id, VASTDieTopology *topology);
+typedef VASTStatus VastapiQueryMemoryUsage(VASTDisplay dpy, VASTContextID context, VASTMemoryUsage *usage);
+typedef VASTStatus VastapiEstimateEncodeMemory(VASTProfile profile, const VAEncMiscParameter *param, VASTMemoryUsage *usage);
+typedef VASTStatus VastapiProcOverlayCacheSetBudget(VASTDisplay dpy, VASTContextID context, uint64_t max_bytes);
+typedef VASTStatus VastapiProcOverlayUpload(VASTDisplay dpy, VASTContextID context, const void *data, uint32_t width, uint32_t height,
+                                            uint32_t pitch, VASTSurfaceID *overlay);
+typedef VASTStatus VastapiProcOverlayEvict(VASTDisplay dpy, VASTContextID context, VASTSurfaceID overlay);
+typedef VASTStatus VastapiProcOverlayCacheQuery(VASTDisplay dpy, VASTContextID context, VASTProcOverlayCacheStats *stats);
+typedef VASTStatus VastapiProcHostQueryFilters(VASTProcFilterType *filters, unsigned int *num_filters, uint32_t *isa_flags);
+typedef VASTStatus VastapiProcHostStateCreate(const FilterParams *filt_params, uint32_t width, uint32_t height, void **state);
+typedef VASTStatus VastapiProcHostStateDestroy(void *state);
+typedef VASTStatus VastapiProcHostRender(const FilterParams *filt_params, void *state, const VASTProcHostFrame *src,
+                                         VASTProcHostFrame *dst, unsigned int num_dst, uint32_t isa);
+typedef VASTStatus VastapiProcHostCompare(const VASTProcHostFrame *ref, const VASTProcHostFrame *test, double *psnr, uint32_t *max_diff);
+typedef VASTStatus VastapiProcHostConvertQuery(VAST_PIX_FTM src_fmt, VAST_PIX_FTM dst_fmt, uint32_t *isa_flags);
+typedef VASTStatus VastapiProcHostConvert(const VASTProcHostFrame *src, VASTProcHostFrame *dst, uint32_t isa);
+typedef VASTStatus VastapiProcHostApplyFilmGrain(const VASTFilmGrainStructAV1 *film_grain, const VASTProcHostFrame *src,
+                                                 VASTProcHostFrame *dst, uint32_t isa);
+typedef VASTStatus VastapiHostFindStartCode(const uint8_t *buf, size_t size, uint32_t isa, size_t *offset);
+typedef VASTStatus VastapiHostSplitNalUnits(VASTProfile profile, const uint8_t *buf, size_t size, VASTHostNalUnit *units,
+                                            unsigned int *num_units, uint32_t isa);
+typedef VASTStatus VastapiHostRemoveEmulationPrevention(const uint8_t *src, size_t src_size, uint8_t *dst, size_t *dst_size,
+                                                        uint32_t isa);
+typedef VASTStatus VastapiHostParserQueryStateSize(VASTProfile profile, size_t *size);
+typedef VASTStatus VastapiHostParserInit(VASTProfile profile, void *state, size_t state_size);
+typedef VASTStatus VastapiHostParsePicture(void *state, const uint8_t *buf, size_t size, VASTSurfaceID target,
+                                           VASTHostParsedPicture *picture, size_t *consumed);
 //common tool api
 typedef void*      VastapiGetMemory(int len);
 typedef void       VastapiFreeMemory(void *ptr);
+typedef VASTStatus VastapiAllocHostMemory(size_t size, const VASTHostMemoryAttrib *attrib, void **ptr);
+typedef VASTStatus VastapiFreeHostMemory(void *ptr);
+typedef VASTStatus VastapiQueryHostMemory(const void *ptr, VASTHostMemoryAttrib *attrib, size_t *size);
 
 typedef struct VastapiFunctions{
     VastapiEncAllowOptimizeDelay    *vastapiEncAllowOptimizeDelay;
@@ -262,13 +332,26 @@ typedef struct VastapiFunctions{
     VastapiHwBuffFree           *vastapiHwBuffFree;
     VastapiHwUnmapFrame         *vastapiHwUnmapFrame;
     VastapiHwMapFrame           *vastapiHwMapFrame;
+    VastapiHwMapCacheInvalidate *vastapiHwMapCacheInvalidate;
     VastapiHwGetConstraints     *vastapiHwGetConstraints;
     VastapiHwSurfaceAddr        *vastapiHwSurfaceAddr;
     VastapiHwSurfaceAddrFromFd  *vastapiHwSurfaceAddrFromFd;
+    VastapiHwSurfaceImportDmaBuf  *vastapiHwSurfaceImportDmaBuf;
+    VastapiHwSurfaceImportRelease *vastapiHwSurfaceImportRelease;
+    VastapiHwSurfaceExportDmaBuf  *vastapiHwSurfaceExportDmaBuf;
+    VastapiHwSurfaceExportRelease *vastapiHwSurfaceExportRelease;
     VastapiHwTransferData       *vastapiHwTransferData;
+    VastapiHwTransferFrameSg    *vastapiHwTransferFrameSg;
+    VastapiHwTransferQueueInit  *vastapiHwTransferQueueInit;
+    VastapiHwTransferDataAsync  *vastapiHwTransferDataAsync;
+    VastapiHwFenceWait          *vastapiHwFenceWait;
     VastapiHwFrameInit          *vastapiHwFrameInit;
     VastapiHwTestDeriveWork     *vastapiHwTestDeriveWork;
     VastapiHwAllocDmaBuff       *vastapiHwAllocDmaBuff;
+    VastapiHwDmaPoolInit        *vastapiHwDmaPoolInit;
+    VastapiHwDmaPoolGet         *vastapiHwDmaPoolGet;
+    VastapiHwDmaPoolPut         *vastapiHwDmaPoolPut;
+    VastapiHwDmaPoolStats       *vastapiHwDmaPoolStats;
 
 
     VastapiDecMakeParamBuffer    *vastapiDecMakeParamBuffer;
@@ -283,11 +366,32 @@ typedef struct VastapiFunctions{
     VastapiDecCreateContext      *vastapiDecCreateContext;
     VastapiDecDestoryConfig      *vastapiDecDestoryConfig;
     VastapiDecGetFmt             *vastapiDecGetFmt;
+    VastapiDecPoolCreate         *vastapiDecPoolCreate;
+    VastapiDecPoolDestroy        *vastapiDecPoolDestroy;
+    VastapiDecPoolGet            *vastapiDecPoolGet;
+    VastapiDecPoolPut            *vastapiDecPoolPut;
+    VastapiDecPoolStats          *vastapiDecPoolStats;
+    VastapiDecReconfigure        *vastapiDecReconfigure;
+    VastapiDecPictureAsync       *vastapiDecPictureAsync;
+    VastapiDecPoll               *vastapiDecPoll;
+    VastapiDecAppendSlice        *vastapiDecAppendSlice;
+    VastapiDecSkipPicture        *vastapiDecSkipPicture;
+    VastapiDecMuxCreate          *vastapiDecMuxCreate;
+    VastapiDecMuxDestroy         *vastapiDecMuxDestroy;
+    VastapiDecMuxAddStream       *vastapiDecMuxAddStream;
+    VastapiDecMuxRemoveStream    *vastapiDecMuxRemoveStream;
+    VastapiDecJpegBatch          *vastapiDecJpegBatch;
+    VastapiDecSyncJpegBatch      *vastapiDecSyncJpegBatch;
 
     VastapiFilterPipelineUnint   *vastapiFilterPipelineUnint;
     VastapiFilterRenderPicture   *vastapiFilterRenderPicture;
     VastapiFilterConfigCreate    *vastapiFilterConfigCreate;
     VastapiFilterContextCreate   *vastapiFilterContextCreate;
+    VastapiFilterRefRingInit     *vastapiFilterRefRingInit;
+    VastapiFilterRefRingFlush    *vastapiFilterRefRingFlush;
+    VastapiFilterRefRingUninit   *vastapiFilterRefRingUninit;
+    VastapiFilterRenderBatch     *vastapiFilterRenderBatch;
+    VastapiFilterSyncBatch       *vastapiFilterSyncBatch;
 
     VastapiQueryVendorString     *vastapiQueryVendorString;
     VastapiDestroyConfig         *vastapiDestroyConfig;
@@ -307,8 +411,21 @@ typedef struct VastapiFunctions{
     VastapiDmaWriteBuf           *vastapiDmaWriteBuf;
     VastapiDmaReadBuf            *vastapiDmaReadBuf;
     vastapiDeviceMemcpy           *vastapiDeviceMemcpy;
+    VastapiQueryPeerAccess       *vastapiQueryPeerAccess;
+    VastapiCopySurfacePeer       *vastapiCopySurfacePeer;
     VastapiGetMemory             *vastapiGetMemory;
     VastapiFreeMemory            *vastapiFreeMemory;
+    VastapiAllocHostMemory       *vastapiAllocHostMemory;
+    VastapiFreeHostMemory        *vastapiFreeHostMemory;
+    VastapiQueryHostMemory       *vastapiQueryHostMemory;
+    VastapiQueryDieTopology      *vastapiQueryDieTopology;
+    VastapiQueryMemoryUsage      *vastapiQueryMemoryUsage;
+    VastapiEstimateEncodeMemory  *vastapiEstimateEncodeMemory;
+
+    VastapiProcOverlayCacheSetBudget *vastapiProcOverlayCacheSetBudget;
+    VastapiProcOverlayUpload     *vastapiProcOverlayUpload;
+    VastapiProcOverlayEvict      *vastapiProcOverlayEvict;
+    VastapiProcOverlayCacheQuery *vastapiProcOverlayCacheQuery;
   
     VASTAPI_LIB_HANDLE           lib;
 
@@ -320,9 +437,27 @@ typedef struct VastapiFunctionsNoDev{
     VastapiFilterParamInit   *vastapiFilterParamInit;
     VastapiFilterParamParse  *vastapiFilterParamParse;
     VastapiGetDieinfo        *vastapiGetDieinfo;
+    VastapiProcHostQueryFilters *vastapiProcHostQueryFilters;
+    VastapiProcHostStateCreate  *vastapiProcHostStateCreate;
+    VastapiProcHostStateDestroy *vastapiProcHostStateDestroy;
+    VastapiProcHostRender    *vastapiProcHostRender;
+    VastapiProcHostCompare   *vastapiProcHostCompare;
+    VastapiProcHostConvertQuery *vastapiProcHostConvertQuery;
+    VastapiProcHostConvert   *vastapiProcHostConvert;
+    VastapiProcHostApplyFilmGrain *vastapiProcHostApplyFilmGrain;
+    VastapiHostFindStartCode *vastapiHostFindStartCode;
+    VastapiHostSplitNalUnits *vastapiHostSplitNalUnits;
+    VastapiHostRemoveEmulationPrevention *vastapiHostRemoveEmulationPrevention;
+    VastapiHostParserQueryStateSize *vastapiHostParserQueryStateSize;
+    VastapiHostParserInit    *vastapiHostParserInit;
+    VastapiHostParsePicture  *vastapiHostParsePicture;
     VastapiHwSurfaceAddr     *vastapiHwSurfaceAddr;
     VastapiGetMemory         *vastapiGetMemory;
     VastapiFreeMemory        *vastapiFreeMemory;
+    VastapiAllocHostMemory   *vastapiAllocHostMemory;
+    VastapiFreeHostMemory    *vastapiFreeHostMemory;
+    VastapiQueryHostMemory   *vastapiQueryHostMemory;
+    VastapiEstimateEncodeMemory *vastapiEstimateEncodeMemory;
 
     VASTAPI_LIB_HANDLE           lib;
 }VastapiFunctionsNoDev;
@@ -395,13 +530,26 @@ static inline int vastapi_load_functions(VastapiFunctions **functions)
     LOAD_SYMBOL(vastapiHwBuffFree,  VastapiHwBuffFree, "vastapi_buffer_free");
     LOAD_SYMBOL(vastapiHwUnmapFrame,  VastapiHwUnmapFrame, "vastapi_unmap_frame_private");
     LOAD_SYMBOL(vastapiHwMapFrame,  VastapiHwMapFrame, "vastapi_map_frame_private");
+    LOAD_SYMBOL_OPT(vastapiHwMapCacheInvalidate,  VastapiHwMapCacheInvalidate, "vastapi_map_cache_invalidate");
     LOAD_SYMBOL(vastapiHwGetConstraints,  VastapiHwGetConstraints, "vastapi_get_constraints");
     LOAD_SYMBOL(vastapiHwSurfaceAddr,  VastapiHwSurfaceAddr, "vastapi_surface_address");
     LOAD_SYMBOL(vastapiHwSurfaceAddrFromFd,  VastapiHwSurfaceAddrFromFd, "vastapi_surface_address_from_fd");
+    LOAD_SYMBOL_OPT(vastapiHwSurfaceImportDmaBuf,  VastapiHwSurfaceImportDmaBuf, "vastapi_surface_import_dmabuf");
+    LOAD_SYMBOL_OPT(vastapiHwSurfaceImportRelease,  VastapiHwSurfaceImportRelease, "vastapi_surface_import_release");
+    LOAD_SYMBOL_OPT(vastapiHwSurfaceExportDmaBuf,  VastapiHwSurfaceExportDmaBuf, "vastapi_surface_export_dmabuf");
+    LOAD_SYMBOL_OPT(vastapiHwSurfaceExportRelease,  VastapiHwSurfaceExportRelease, "vastapi_surface_export_release");
     LOAD_SYMBOL(vastapiHwTransferData,  VastapiHwTransferData, "vastapi_transfer_data");
+    LOAD_SYMBOL_OPT(vastapiHwTransferFrameSg,  VastapiHwTransferFrameSg, "vastapi_transfer_frame_sg");
+    LOAD_SYMBOL_OPT(vastapiHwTransferQueueInit,  VastapiHwTransferQueueInit, "vastapi_transfer_queue_init");
+    LOAD_SYMBOL_OPT(vastapiHwTransferDataAsync,  VastapiHwTransferDataAsync, "vastapi_transfer_data_async");
+    LOAD_SYMBOL_OPT(vastapiHwFenceWait,  VastapiHwFenceWait, "vastapi_fence_wait");
     LOAD_SYMBOL(vastapiHwFrameInit,  VastapiHwFrameInit, "vastapi_frames_init_private");
     LOAD_SYMBOL(vastapiHwTestDeriveWork,  VastapiHwTestDeriveWork, "vastapi_test_derive_work");
     LOAD_SYMBOL(vastapiHwAllocDmaBuff,  VastapiHwAllocDmaBuff, "vastapi_dmabuff_alloc");
+    LOAD_SYMBOL_OPT(vastapiHwDmaPoolInit,  VastapiHwDmaPoolInit, "vastapi_dma_pool_init");
+    LOAD_SYMBOL_OPT(vastapiHwDmaPoolGet,  VastapiHwDmaPoolGet, "vastapi_dma_pool_get");
+    LOAD_SYMBOL_OPT(vastapiHwDmaPoolPut,  VastapiHwDmaPoolPut, "vastapi_dma_pool_put");
+    LOAD_SYMBOL_OPT(vastapiHwDmaPoolStats,  VastapiHwDmaPoolStats, "vastapi_dma_pool_stats");
 
 
     LOAD_SYMBOL(vastapiDecMakeParamBuffer, VastapiDecMakeParamBuffer, "vastapi_decode_make_param_buffer");
@@ -416,11 +564,32 @@ static inline int vastapi_load_functions(VastapiFunctions **functions)
     LOAD_SYMBOL(vastapiDecCreateContext,   VastapiDecCreateContext, "vastapi_create_dec_context");
     LOAD_SYMBOL(vastapiDecDestoryConfig,   VastapiDecDestoryConfig, "vastapi_destroy_config");
     LOAD_SYMBOL(vastapiDecGetFmt,          VastapiDecGetFmt, "vastapi_dec_get_format");
+    LOAD_SYMBOL_OPT(vastapiDecPoolCreate,  VastapiDecPoolCreate, "vastapi_dec_pool_create");
+    LOAD_SYMBOL_OPT(vastapiDecPoolDestroy, VastapiDecPoolDestroy, "vastapi_dec_pool_destroy");
+    LOAD_SYMBOL_OPT(vastapiDecPoolGet,     VastapiDecPoolGet, "vastapi_dec_pool_get");
+    LOAD_SYMBOL_OPT(vastapiDecPoolPut,     VastapiDecPoolPut, "vastapi_dec_pool_put");
+    LOAD_SYMBOL_OPT(vastapiDecPoolStats,   VastapiDecPoolStats, "vastapi_dec_pool_stats");
+    LOAD_SYMBOL_OPT(vastapiDecReconfigure, VastapiDecReconfigure, "vastapi_decode_reconfigure");
+    LOAD_SYMBOL_OPT(vastapiDecPictureAsync, VastapiDecPictureAsync, "vastapi_decode_picture_async");
+    LOAD_SYMBOL_OPT(vastapiDecPoll,        VastapiDecPoll, "vastapi_decode_poll");
+    LOAD_SYMBOL_OPT(vastapiDecAppendSlice, VastapiDecAppendSlice, "vastapi_decode_append_slice");
+    LOAD_SYMBOL_OPT(vastapiDecSkipPicture, VastapiDecSkipPicture, "vastapi_decode_skip_picture");
+    LOAD_SYMBOL_OPT(vastapiDecMuxCreate,   VastapiDecMuxCreate, "vastapi_dec_mux_create");
+    LOAD_SYMBOL_OPT(vastapiDecMuxDestroy,  VastapiDecMuxDestroy, "vastapi_dec_mux_destroy");
+    LOAD_SYMBOL_OPT(vastapiDecMuxAddStream, VastapiDecMuxAddStream, "vastapi_dec_mux_add_stream");
+    LOAD_SYMBOL_OPT(vastapiDecMuxRemoveStream, VastapiDecMuxRemoveStream, "vastapi_dec_mux_remove_stream");
+    LOAD_SYMBOL_OPT(vastapiDecJpegBatch,   VastapiDecJpegBatch, "vastapi_decode_jpeg_batch");
+    LOAD_SYMBOL_OPT(vastapiDecSyncJpegBatch, VastapiDecSyncJpegBatch, "vastapi_sync_jpeg_batch");
 
     LOAD_SYMBOL(vastapiFilterPipelineUnint,  VastapiFilterPipelineUnint, "vastfilter_pipeline_uninit");
     LOAD_SYMBOL(vastapiFilterRenderPicture,  VastapiFilterRenderPicture, "vastfilter_render_picture");
     LOAD_SYMBOL(vastapiFilterConfigCreate,   VastapiFilterConfigCreate, "vafilter_create_config");
     LOAD_SYMBOL(vastapiFilterContextCreate,  VastapiFilterContextCreate, "vafilter_creat_context");
+    LOAD_SYMBOL_OPT(vastapiFilterRefRingInit,    VastapiFilterRefRingInit, "vastfilter_ref_ring_init");
+    LOAD_SYMBOL_OPT(vastapiFilterRefRingFlush,   VastapiFilterRefRingFlush, "vastfilter_ref_ring_flush");
+    LOAD_SYMBOL_OPT(vastapiFilterRefRingUninit,  VastapiFilterRefRingUninit, "vastfilter_ref_ring_uninit");
+    LOAD_SYMBOL_OPT(vastapiFilterRenderBatch,    VastapiFilterRenderBatch, "vastfilter_render_batch");
+    LOAD_SYMBOL_OPT(vastapiFilterSyncBatch,      VastapiFilterSyncBatch, "vastfilter_sync_batch");
 
     LOAD_SYMBOL(vastapiQueryVendorString, VastapiQueryVendorString, "vastQueryVendorString");
     LOAD_SYMBOL(vastapiDestroyConfig,     VastapiDestroyConfig, "vastDestroyConfig");
@@ -440,9 +609,22 @@ static inline int vastapi_load_functions(VastapiFunctions **functions)
     LOAD_SYMBOL(vastapiDmaWriteBuf,       VastapiDmaWriteBuf, "vastDmaWriteBuf");
     LOAD_SYMBOL(vastapiDmaReadBuf,        VastapiDmaReadBuf, "vastDmaReadBuf");
     LOAD_SYMBOL(vastapiDeviceMemcpy,        vastapiDeviceMemcpy, "vastDeviceMemcpy");
+    LOAD_SYMBOL_OPT(vastapiQueryPeerAccess, VastapiQueryPeerAccess, "vastQueryPeerAccess");
+    LOAD_SYMBOL_OPT(vastapiCopySurfacePeer, VastapiCopySurfacePeer, "vastCopySurfacePeer");
 
     LOAD_SYMBOL(vastapiGetMemory,         VastapiGetMemory, "vastapi_malloc_memory");
     LOAD_SYMBOL(vastapiFreeMemory,        VastapiFreeMemory, "vastapi_free_memory");
+    LOAD_SYMBOL_OPT(vastapiAllocHostMemory,   VastapiAllocHostMemory, "vastAllocHostMemory");
+    LOAD_SYMBOL_OPT(vastapiFreeHostMemory,    VastapiFreeHostMemory, "vastFreeHostMemory");
+    LOAD_SYMBOL_OPT(vastapiQueryHostMemory,   VastapiQueryHostMemory, "vastQueryHostMemory");
+    LOAD_SYMBOL_OPT(vastapiQueryDieTopology,  VastapiQueryDieTopology, "vastQueryDieTopology");
+    LOAD_SYMBOL_OPT(vastapiQueryMemoryUsage,  VastapiQueryMemoryUsage, "vastQueryMemoryUsage");
+    LOAD_SYMBOL_OPT(vastapiEstimateEncodeMemory, VastapiEstimateEncodeMemory, "vastEstimateEncodeMemory");
+
+    LOAD_SYMBOL_OPT(vastapiProcOverlayCacheSetBudget, VastapiProcOverlayCacheSetBudget, "vastProcOverlayCacheSetBudget");
+    LOAD_SYMBOL_OPT(vastapiProcOverlayUpload,     VastapiProcOverlayUpload, "vastProcOverlayUpload");
+    LOAD_SYMBOL_OPT(vastapiProcOverlayEvict,      VastapiProcOverlayEvict, "vastProcOverlayEvict");
+    LOAD_SYMBOL_OPT(vastapiProcOverlayCacheQuery, VastapiProcOverlayCacheQuery, "vastProcOverlayCacheQuery");
 
     GENERIC_LOAD_FUNC_FINALE(vastapi);
 }
@@ -464,8 +646,29 @@ static inline int vastapi_nodev_load_functions(VastapiFunctionsNoDev **functions
     LOAD_SYMBOL(vastapiHwSurfaceAddr,      VastapiHwSurfaceAddr, "vastapi_surface_address");
     LOAD_SYMBOL(vastapiGetMemory,          VastapiGetMemory, "vastapi_malloc_memory");
     LOAD_SYMBOL(vastapiFreeMemory,         VastapiFreeMemory, "vastapi_free_memory");
+    LOAD_SYMBOL_OPT(vastapiAllocHostMemory,    VastapiAllocHostMemory, "vastAllocHostMemory");
+    LOAD_SYMBOL_OPT(vastapiFreeHostMemory,     VastapiFreeHostMemory, "vastFreeHostMemory");
+    LOAD_SYMBOL_OPT(vastapiQueryHostMemory,    VastapiQueryHostMemory, "vastQueryHostMemory");
+    LOAD_SYMBOL_OPT(vastapiEstimateEncodeMemory, VastapiEstimateEncodeMemory, "vastEstimateEncodeMemory");
     LOAD_SYMBOL(vastapiGetDieinfo,         VastapiGetDieinfo, "vastGetDieinfo");
 
+    LOAD_SYMBOL_OPT(vastapiProcHostQueryFilters, VastapiProcHostQueryFilters, "vastProcHostQueryFilters");
+    LOAD_SYMBOL_OPT(vastapiProcHostStateCreate,  VastapiProcHostStateCreate, "vastProcHostStateCreate");
+    LOAD_SYMBOL_OPT(vastapiProcHostStateDestroy, VastapiProcHostStateDestroy, "vastProcHostStateDestroy");
+    LOAD_SYMBOL_OPT(vastapiProcHostRender,       VastapiProcHostRender, "vastProcHostRender");
+    LOAD_SYMBOL_OPT(vastapiProcHostCompare,      VastapiProcHostCompare, "vastProcHostCompare");
+    LOAD_SYMBOL_OPT(vastapiProcHostConvertQuery, VastapiProcHostConvertQuery, "vastProcHostConvertQuery");
+    LOAD_SYMBOL_OPT(vastapiProcHostConvert,      VastapiProcHostConvert, "vastProcHostConvert");
+    LOAD_SYMBOL_OPT(vastapiProcHostApplyFilmGrain, VastapiProcHostApplyFilmGrain, "vastProcHostApplyFilmGrain");
+
+    LOAD_SYMBOL_OPT(vastapiHostFindStartCode,    VastapiHostFindStartCode, "vastHostFindStartCode");
+    LOAD_SYMBOL_OPT(vastapiHostSplitNalUnits,    VastapiHostSplitNalUnits, "vastHostSplitNalUnits");
+    LOAD_SYMBOL_OPT(vastapiHostRemoveEmulationPrevention, VastapiHostRemoveEmulationPrevention,
+                    "vastHostRemoveEmulationPrevention");
+    LOAD_SYMBOL_OPT(vastapiHostParserQueryStateSize, VastapiHostParserQueryStateSize, "vastHostParserQueryStateSize");
+    LOAD_SYMBOL_OPT(vastapiHostParserInit,       VastapiHostParserInit, "vastHostParserInit");
+    LOAD_SYMBOL_OPT(vastapiHostParsePicture,     VastapiHostParsePicture, "vastHostParsePicture");
+
     GENERIC_LOAD_FUNC_FINALE(vastapi_nodev);
 }
 